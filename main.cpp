@@ -6,6 +6,9 @@
 #include <cctype>
 #include <stdexcept>
 #include <vector>
+#include <thread>
+#include <system_error>
+#include <algorithm>
 
 using namespace std;
 
@@ -306,6 +309,231 @@ void testReversedString() {
     assert(reversedString("abc") == "cba");
 }
 
+// =============================================================================
+// Batch String Analysis Implementation
+// =============================================================================
+
+// Below this many records a batch is processed on the calling thread; the cost
+// of starting workers outweighs the work for small batches.
+constexpr size_t MIN_RECORDS_PER_THREAD = 1 << 14;
+
+// Throws if the offsets of a batch do not describe valid record boundaries.
+static void validateBatch(const StringBatchView & batch) {
+    if(batch.count == 0) {
+        return;
+    }
+    if(batch.data == nullptr || batch.offsets == nullptr || batch.offsets[0] < 0) {
+        throw std::invalid_argument("Malformed StringBatchView.");
+    }
+    for(size_t i = 0; i < batch.count; i++) {
+        if(batch.offsets[i + 1] < batch.offsets[i]) {
+            throw std::invalid_argument("StringBatchView offsets must be non-decreasing.");
+        }
+    }
+}
+
+// Number of threads used for a batch of count records: one per core, but no
+// more than keeps MIN_RECORDS_PER_THREAD records on each.
+static size_t batchThreadCount(size_t count) {
+    size_t threadCount = max<size_t>(1, thread::hardware_concurrency());
+    return max<size_t>(1, min(threadCount, count / MIN_RECORDS_PER_THREAD));
+}
+
+// Splits [0, count) into threadCount contiguous ranges and calls work(begin, end)
+// for each, one range per thread. Range starts are multiples of 8 so that
+// workers writing a result bitmap never share a byte. If a worker thread cannot
+// be started its range runs on the calling thread instead; jthread joins any
+// started workers even if work throws on the calling thread.
+template<typename Work>
+static void forEachBatchRange(size_t count, size_t threadCount, Work work) {
+    if(threadCount <= 1) {
+        work(size_t{0}, count);
+        return;
+    }
+    size_t rangeSize = ((count + threadCount - 1) / threadCount + 7) & ~size_t{7};
+    vector<jthread> workers;
+    workers.reserve(threadCount - 1);
+    for(size_t begin = rangeSize; begin < count; begin += rangeSize) {
+        size_t end = min(begin + rangeSize, count);
+        try {
+            workers.emplace_back(work, begin, end);
+        } catch(const std::system_error &) {
+            work(begin, end);
+        }
+    }
+    work(size_t{0}, min(rangeSize, count));  // The calling thread takes the first range.
+}
+
+// Evaluates predicate(record, length) for every record and packs the results
+// into resultBitmap, one bit per record.
+template<typename Predicate>
+static void evaluateBatch(const StringBatchView & batch, vector<uint8_t> & resultBitmap,
+                          size_t threadCount, Predicate predicate) {
+    validateBatch(batch);
+    resultBitmap.assign((batch.count + 7) / 8, 0);
+    forEachBatchRange(batch.count, threadCount, [&](size_t begin, size_t end) {
+        for(size_t i = begin; i < end; i += 8) {
+            uint8_t bits = 0;
+            size_t last = min(i + 8, end);
+            for(size_t j = i; j < last; j++) {
+                const char* record = batch.data + batch.offsets[j];
+                size_t length = static_cast<size_t>(batch.offsets[j + 1] - batch.offsets[j]);
+                bits |= static_cast<uint8_t>(predicate(record, length)) << (j - i);
+            }
+            resultBitmap[i / 8] = bits;
+        }
+    });
+}
+
+/*
+    With only one kind of brace the stack in areCurleyBracesMatched() never holds
+    anything but '{', so its size alone carries the state. The batch version
+    tracks that size as a counter instead of building a stack per record.
+*/
+static void areCurleyBracesMatchedBatch(const StringBatchView & batch, vector<uint8_t> & resultBitmap,
+                                        size_t threadCount) {
+    evaluateBatch(batch, resultBitmap, threadCount, [](const char* record, size_t length) {
+        size_t depth = 0;
+        for(size_t i = 0; i < length; i++) {
+            if(record[i] == '{') {
+                depth++;
+            } else if(record[i] == '}') {
+                if(depth == 0) {
+                    return false;
+                }
+                depth--;
+            }
+        }
+        return depth == 0;
+    });
+}
+
+void areCurleyBracesMatchedBatch(const StringBatchView & batch, vector<uint8_t> & resultBitmap) {
+    areCurleyBracesMatchedBatch(batch, resultBitmap, batchThreadCount(batch.count));
+}
+
+/*
+    Compares each record's characters from both ends toward the middle, which
+    gives the same answer as comparing against the stack-reversed copy without
+    allocating one.
+*/
+static void isPalindromeBatch(const StringBatchView & batch, vector<uint8_t> & resultBitmap,
+                              size_t threadCount) {
+    evaluateBatch(batch, resultBitmap, threadCount, [](const char* record, size_t length) {
+        for(size_t i = 0, j = length; i + 1 < j; i++, j--) {
+            if(record[i] != record[j - 1]) {
+                return false;
+            }
+        }
+        return true;
+    });
+}
+
+void isPalindromeBatch(const StringBatchView & batch, vector<uint8_t> & resultBitmap) {
+    isPalindromeBatch(batch, resultBitmap, batchThreadCount(batch.count));
+}
+
+/*
+    Reverses every record straight into one shared output buffer. Output offsets
+    are the input offsets rebased to start at zero, so each worker writes a
+    disjoint slice of the output.
+*/
+static void reversedStringBatch(const StringBatchView & batch, string & output, size_t threadCount) {
+    validateBatch(batch);
+    if(batch.count == 0) {
+        output.clear();
+        return;
+    }
+    int32_t base = batch.offsets[0];
+    output.resize(static_cast<size_t>(batch.offsets[batch.count] - base));
+    forEachBatchRange(batch.count, threadCount, [&](size_t begin, size_t end) {
+        char* out = output.data() + (batch.offsets[begin] - base);
+        for(size_t i = begin; i < end; i++) {
+            const char* recordEnd = batch.data + batch.offsets[i + 1];
+            out = reverse_copy(batch.data + batch.offsets[i], recordEnd, out);
+        }
+    });
+}
+
+void reversedStringBatch(const StringBatchView & batch, string & output) {
+    reversedStringBatch(batch, output, batchThreadCount(batch.count));
+}
+
+// Runs every batch function over records[first, first + batch.count) using
+// threadCount threads and checks each record against the single-record function.
+static void checkStringBatch(const StringBatchView & batch, const vector<string> & records,
+                             size_t first, size_t threadCount) {
+    vector<uint8_t> braces;
+    vector<uint8_t> palindromes;
+    string reversed;
+    areCurleyBracesMatchedBatch(batch, braces, threadCount);
+    isPalindromeBatch(batch, palindromes, threadCount);
+    reversedStringBatch(batch, reversed, threadCount);
+    assert(braces.size() == (batch.count + 7) / 8);
+    assert(palindromes.size() == (batch.count + 7) / 8);
+    for(size_t i = 0; i < batch.count; i++) {
+        const string & record = records[first + i];
+        bool braceBit = (braces[i / 8] >> (i % 8)) & 1;
+        bool palindromeBit = (palindromes[i / 8] >> (i % 8)) & 1;
+        size_t outputOffset = static_cast<size_t>(batch.offsets[i] - batch.offsets[0]);
+        assert(braceBit == areCurleyBracesMatched(record));
+        assert(palindromeBit == isPalindrome(record));
+        assert(reversed.substr(outputOffset, record.size()) == reversedString(record));
+    }
+    assert(reversed.size() == static_cast<size_t>(batch.offsets[batch.count] - batch.offsets[0]));
+}
+
+// Unit test for the batch functions. Each batch result must agree with the
+// single-record function on every record, whether the batch runs on the calling
+// thread or is split across workers.
+void testStringBatch() {
+    vector<string> samples = {"", "a", "ab", "aba", "abba", "{}", "a{b{c}", "}{", "{a}{b}", "abaa", "{{}}"};
+    vector<string> records;
+    string data;
+    vector<int32_t> offsets = {0};
+    // 11 samples repeat with a period that is not a multiple of 8, so every
+    // sample lands on either side of some 8-aligned range boundary.
+    for(int i = 0; i < 100000; i++) {
+        records.push_back(samples[i % samples.size()]);
+        data += records.back();
+        offsets.push_back(static_cast<int32_t>(data.size()));
+    }
+
+    // Single-threaded, and forced splits that start worker threads even on a
+    // single-core machine: 37 records over 3 threads gives ranges [0, 16),
+    // [16, 32) and [32, 37); 100000 over 4 gives boundaries at multiples of 25000.
+    StringBatchView small{data.data(), offsets.data(), 37};
+    checkStringBatch(small, records, 0, 1);
+    checkStringBatch(small, records, 0, 3);
+    StringBatchView large{data.data(), offsets.data(), records.size()};
+    checkStringBatch(large, records, 0, 4);
+    checkStringBatch(large, records, 0, 7);
+
+    // A sliced view: offsets[0] > 0, and output offsets are rebased to zero.
+    size_t first = 5;
+    StringBatchView sliced{data.data(), offsets.data() + first, 40};
+    checkStringBatch(sliced, records, first, 1);
+    checkStringBatch(sliced, records, first, 3);
+
+    // The public entry points pick their own thread count.
+    vector<uint8_t> palindromes;
+    string reversed;
+    isPalindromeBatch(small, palindromes);
+    reversedStringBatch(sliced, reversed);
+    assert(((palindromes[0] >> 3) & 1) == isPalindrome(records[3]));
+    assert(reversed.substr(0, records[first].size()) == reversedString(records[first]));
+
+    // Malformed offsets are rejected.
+    int32_t badOffsets[] = {0, 2, 1};
+    bool threw = false;
+    try {
+        isPalindromeBatch(StringBatchView{"ab", badOffsets, 2}, palindromes);
+    } catch(const std::invalid_argument &) {
+        threw = true;
+    }
+    assert(threw);
+}
+
 // =============================================================================
 // Infix to Postfix Converter Implementation (Part 3)
 // =============================================================================
@@ -388,6 +616,7 @@ int main() {
     testAreCurleyBracesMatched(); // Test the matching curly brace detector.
     testIsPalindrome();           // Test the palindrome detector.
     testReversedString();         // Test the string reverser.
+    testStringBatch();            // Test the batch string analysis functions.
     testInfixToPostFix();         // Test the infix-to-postfix converter.
     
     cout << "All tests passed successfully." << endl;
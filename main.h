@@ -2,6 +2,9 @@
 #define MAIN_H
 
 #include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
 
 // *****************************************************************************
 // StackADT Interface
@@ -92,6 +95,32 @@ std::string reversedString(const std::string & inputString);
 //     into postfix notation (e.g., abc*+), observing operator precedence.
 std::string infixToPostFix(const std::string & infix);
 
+// *****************************************************************************
+// Batch String Analysis
+// *****************************************************************************
+// A read-only view over many short records packed into one contiguous buffer
+// (Arrow-style). Record i occupies data[offsets[i], offsets[i + 1]), so the
+// offsets array holds count + 1 non-decreasing entries starting at >= 0.
+struct StringBatchView {
+    const char* data;        // Concatenated bytes of every record.
+    const std::int32_t* offsets;  // count + 1 record boundaries into data.
+    std::size_t count;       // Number of records in the batch.
+};
+
+// Batch versions of (A)-(C). Each processes the whole batch in one call,
+// splitting large batches across worker threads. Boolean results are written
+// to a bitmap of (count + 7) / 8 bytes where bit (i % 8) of byte (i / 8) holds
+// the result for record i. Unlike the single-record functions these do not
+// build a fixed-size stack per record, so records are not limited to
+// MIN_ARRAY_SIZE characters. Malformed offsets throw std::invalid_argument.
+void areCurleyBracesMatchedBatch(const StringBatchView & batch, std::vector<std::uint8_t> & resultBitmap);
+void isPalindromeBatch(const StringBatchView & batch, std::vector<std::uint8_t> & resultBitmap);
+
+// Writes every record reversed into output, which is resized to the batch's
+// total byte length. Record i of the output starts at offsets[i] - offsets[0],
+// so a sliced view (offsets[0] > 0) yields an output that starts at zero.
+void reversedStringBatch(const StringBatchView & batch, std::string & output);
+
 // *****************************************************************************
 // Unit Test Function Prototypes
 // *****************************************************************************
@@ -100,6 +129,7 @@ void testListStack();
 void testAreCurleyBracesMatched();
 void testIsPalindrome();
 void testReversedString();
+void testStringBatch();
 void testInfixToPostFix();
 
 #endif // MAIN_H